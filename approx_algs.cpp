@@ -1,6 +1,7 @@
 #include <algorithm>
 #include <stack>
 #include <limits>
+#include <tuple>
 
 #include "approx_algs.hpp"
 
@@ -72,24 +73,35 @@ public:
  * Calculates the minimum spanning tree (MST) of a given graph using Prim's algorithm.
  * 
  * @param graph The input graph represented as a 2D vector of floats.
- * @return The MST of the input graph represented as a 2D vector of floats.
+ * @param shouldStop Optional predicate polled once per vertex added to the tree.
+ * @return The MST of the input graph represented as a 2D vector of floats, or an empty matrix if stopped.
  */
-std::vector<std::vector<float>> prim_mst(const std::vector<std::vector<float>>& graph) {
+std::vector<std::vector<float>> prim_mst(const std::vector<std::vector<float>>& graph, const std::function<bool()>& shouldStop) {
+  // Allocating the n x n tree is itself O(n^2), so check before paying for it
+  if (shouldStop && shouldStop()) {
+    return {};
+  }
   int numVertices = graph.size();
   std::vector<std::vector<float>> mst(numVertices, std::vector<float>(numVertices, 0));
   std::vector<bool> visited(numVertices, false);
+  int numVisited = 0;
   MinHeap heap;
 
   // (weight, vertex, parent)
   heap.push(std::make_tuple(0.0, 0, -1));
 
-  while (!heap.empty()) {
+  // Stop once every vertex is in the tree, instead of draining the stale heap entries left behind
+  while (!heap.empty() && numVisited < numVertices) {
     auto [weight, vertex, parent] = heap.top();
     heap.pop();
     if (visited[vertex]) {
       continue;
     }
+    if (shouldStop && shouldStop()) {
+      return {};
+    }
     visited[vertex] = true;
+    ++numVisited;
     if (parent != -1) {
       mst[parent][vertex] = weight;
       mst[vertex][parent] = weight;
@@ -110,9 +122,10 @@ std::vector<std::vector<float>> prim_mst(const std::vector<std::vector<float>>&
  * It returns a vector of integers representing the order in which the vertices were visited during the walk.
  * 
  * @param tree The tree represented as an adjacency matrix.
- * @return std::vector<int> The order in which the vertices were visited during the walk.
+ * @param shouldStop Optional predicate polled once per visited vertex.
+ * @return std::vector<int> The order in which the vertices were visited during the walk, or an empty vector if stopped.
  */
-std::vector<int> tree_preorder_walk(const std::vector<std::vector<float>>& tree) {
+std::vector<int> tree_preorder_walk(const std::vector<std::vector<float>>& tree, const std::function<bool()>& shouldStop) {
   int numVertices = tree.size();
   std::vector<bool> visited(numVertices, false);
   std::stack<int> stack;
@@ -124,6 +137,7 @@ std::vector<int> tree_preorder_walk(const std::vector<std::vector<float>>& tree)
     int vertex = stack.top();
     stack.pop();
     if (visited[vertex]) continue;
+    if (shouldStop && shouldStop()) return {};
     visited[vertex] = true;
     walk.push_back(vertex);
     for (int neighbor = 0; neighbor < numVertices; ++neighbor) {
@@ -141,12 +155,18 @@ std::vector<int> tree_preorder_walk(const std::vector<std::vector<float>>& tree)
  * This class provides a dynamic array-like container that can store a sequence of integers.
  * It supports various operations such as adding, removing, and accessing elements.
  */
-std::vector<int> twice_around_the_tree(const std::vector<std::vector<float>>& graph) {
+std::vector<int> twice_around_the_tree(const std::vector<std::vector<float>>& graph, const std::function<bool()>& shouldStop) {
   // Calculate the MST
-  std::vector<std::vector<float>> mst = prim_mst(graph);
+  std::vector<std::vector<float>> mst = prim_mst(graph, shouldStop);
+  if (mst.empty()) {
+    return {};
+  }
 
   // Perform a preorder walk on the MST
-  std::vector<int> walk = tree_preorder_walk(mst);
+  std::vector<int> walk = tree_preorder_walk(mst, shouldStop);
+  if (walk.empty()) {
+    return {};
+  }
 
   // Append the first vertex to the end of the walk to form a cycle
   walk.push_back(walk[0]);
@@ -160,12 +180,17 @@ std::vector<int> twice_around_the_tree(const std::vector<std::vector<float>>& gr
  * @param mst The minimum spanning tree to store the matching edges.
  * @param graph The input graph represented as an adjacency matrix.
  * @param vertices The list of vertices in the graph.
+ * @param shouldStop Optional predicate polled once per matched vertex.
+ * @return True if the matching was completed, false if stopped.
  */
-void minimum_perfect_matching(std::vector<std::vector<float>>& mst, const std::vector<std::vector<float>>& graph, const std::vector<int>& vertices) {
+bool minimum_perfect_matching(std::vector<std::vector<float>>& mst, const std::vector<std::vector<float>>& graph, const std::vector<int>& vertices, const std::function<bool()>& shouldStop) {
   std::vector<bool> matched(vertices.size(), false);
 
   for (size_t i = 0; i < vertices.size(); ++i) {
     if (!matched[i]) {
+      if (shouldStop && shouldStop()) {
+        return false;
+      }
       int vertex = vertices[i];
       float minWeight = std::numeric_limits<float>::max();
       int minVertex = -1;
@@ -183,14 +208,18 @@ void minimum_perfect_matching(std::vector<std::vector<float>>& mst, const std::v
       matched[std::find(vertices.begin(), vertices.end(), minVertex) - vertices.begin()] = true;
     }
   }
+  return true;
 }
 
-std::vector<int> eulerian_tour(std::vector<std::vector<float>>& graph) {
+std::vector<int> eulerian_tour(std::vector<std::vector<float>>& graph, const std::function<bool()>& shouldStop) {
   std::vector<int> tour;
   std::stack<int> stack;
 
   int vertex = 0;
   while (!stack.empty() || std::count_if(graph[vertex].begin(), graph[vertex].end(), [](float weight) { return weight > 0; }) > 0) {
+    if (shouldStop && shouldStop()) {
+      return {};
+    }
     if (std::count_if(graph[vertex].begin(), graph[vertex].end(), [](float weight) { return weight > 0; }) == 0) {
       tour.push_back(vertex);
       vertex = stack.top();
@@ -208,39 +237,114 @@ std::vector<int> eulerian_tour(std::vector<std::vector<float>>& graph) {
   return tour;
 }
 
-void removeDuplicate(std::vector<int>& vec) {
+bool removeDuplicate(std::vector<int>& vec, const std::function<bool()>& shouldStop) {
   if (vec.size() < 3) {
     // Nothing to remove if the vector has less than 3 elements
-    return;
+    return true;
   }
 
   // Iterate from the second element to the second-to-last element
   for (auto it = vec.begin() + 1; it != vec.end() - 1; ++it) {
+    if (shouldStop && shouldStop()) {
+      return false;
+    }
     auto dupIt = std::find(it + 1, vec.end() - 1, *it);
     if (dupIt != vec.end() - 1) {
       vec.erase(dupIt);
     }
   }
+  return true;
 }
 
-std::vector<int> christofides_tsp(std::vector<std::vector<float>>& graph) {
+std::vector<int> christofides_tsp(const std::vector<std::vector<float>>& graph, const std::function<bool()>& shouldStop) {
   // Calculate the MST
-  std::vector<std::vector<float>> mst = prim_mst(graph);
+  std::vector<std::vector<float>> mst = prim_mst(graph, shouldStop);
+  if (mst.empty()) {
+    return {};
+  }
 
   // Find vertices with odd degree in the MST
   std::vector<int> oddVertices;
   for (size_t vertex = 0; vertex < mst.size(); ++vertex) {
+    if (shouldStop && shouldStop()) {
+      return {};
+    }
     if (std::count_if(mst[vertex].begin(), mst[vertex].end(), [](float weight) { return weight > 0; }) % 2 != 0) {
       oddVertices.push_back(vertex);
     }
   }
 
   // Add minimum perfect matching to the MST
-  minimum_perfect_matching(mst, graph, oddVertices);
+  if (!minimum_perfect_matching(mst, graph, oddVertices, shouldStop)) {
+    return {};
+  }
 
   // Calculate an Eulerian tour of the MST
-  std::vector<int> tour = eulerian_tour(mst);
-  removeDuplicate(tour);
+  std::vector<int> tour = eulerian_tour(mst, shouldStop);
+  if (tour.empty()) {
+    return {};
+  }
+  if (!removeDuplicate(tour, shouldStop)) {
+    return {};
+  }
+
+  return tour;
+}
+
+std::vector<int> nearest_neighbor_tour(const std::vector<std::vector<float>>& graph, const std::function<bool()>& shouldStop) {
+  int numVertices = graph.size();
+  if (numVertices == 0) {
+    return {};
+  }
+  std::vector<int> tour;
+  tour.reserve(numVertices + 1);
+  tour.push_back(0);
+
+  // Unvisited vertices are kept packed, so each step only scans the ones left
+  std::vector<int> unvisited(numVertices - 1);
+  for (int i = 1; i < numVertices; ++i) {
+    unvisited[i - 1] = i;
+  }
+
+  while (!unvisited.empty()) {
+    if (shouldStop && shouldStop()) {
+      return {};
+    }
+    const std::vector<float>& distances = graph[tour.back()];
+    size_t closest = 0;
+    for (size_t i = 1; i < unvisited.size(); ++i) {
+      if (distances[unvisited[i]] < distances[unvisited[closest]]) {
+        closest = i;
+      }
+    }
+    tour.push_back(unvisited[closest]);
+    unvisited[closest] = unvisited.back();
+    unvisited.pop_back();
+  }
 
+  // Return to the starting vertex to form a cycle
+  tour.push_back(tour[0]);
   return tour;
 }
+
+bool two_opt_pass(const std::vector<std::vector<float>>& graph, std::vector<int>& tour, const std::function<bool()>& shouldStop) {
+  int numCities = tour.size() - 1;
+  bool improved = false;
+
+  for (int i = 1; i < numCities - 1; ++i) {
+    if (shouldStop && shouldStop()) {
+      break;
+    }
+    for (int j = i + 1; j < numCities; ++j) {
+      // Replace edges (i-1, i) and (j, j+1) with (i-1, j) and (i, j+1).
+      // Summing in double keeps float rounding from making a move and its inverse both look improving.
+      double delta = (double)graph[tour[i - 1]][tour[j]] + graph[tour[i]][tour[j + 1]]
+                   - graph[tour[i - 1]][tour[i]] - graph[tour[j]][tour[j + 1]];
+      if (delta < -1e-4) {
+        std::reverse(tour.begin() + i, tour.begin() + j + 1);
+        improved = true;
+      }
+    }
+  }
+  return improved;
+}
@@ -1,6 +1,14 @@
+#include <functional>
 #include <vector>
 
-std::vector<int> christofides_tsp(std::vector<std::vector<float>>& graph);
+/**
+ * @brief Approximate the Traveling Salesman Problem (TSP) using Christofides' algorithm.
+ * 
+ * @param graph The input graph represented as a 2D vector of floats.
+ * @param shouldStop Optional predicate polled while building the tour; the function gives up once it yields true.
+ * @return std::vector<int> An approximate solution to the TSP, or an empty vector if stopped.
+ */
+std::vector<int> christofides_tsp(const std::vector<std::vector<float>>& graph, const std::function<bool()>& shouldStop = nullptr);
 
 /**
  * @brief Approximate the Traveling Salesman Problem (TSP) using a given graph.
@@ -9,6 +17,30 @@ std::vector<int> christofides_tsp(std::vector<std::vector<float>>& graph);
  * The graph should be a symmetric matrix, where each element represents the distance between two vertices.
  * 
  * @param graph The input graph represented as a 2D vector of floats.
- * @return std::vector<int> An approximate solution to the TSP represented as a vector of integers.
+ * @param shouldStop Optional predicate polled while building the tour; the function gives up once it yields true.
+ * @return std::vector<int> An approximate solution to the TSP represented as a vector of integers, or an empty vector if stopped.
+ */
+std::vector<int> twice_around_the_tree(const std::vector<std::vector<float>>& graph, const std::function<bool()>& shouldStop = nullptr);
+
+/**
+ * @brief Approximate the Traveling Salesman Problem (TSP) by always moving to the closest unvisited vertex.
+ * 
+ * Cheaper than the MST-based constructors and allocates no matrix, so it is the first tour to try under a tight budget.
+ * 
+ * @param graph The input graph represented as a 2D vector of floats.
+ * @param shouldStop Optional predicate polled once per vertex added to the tour; the function gives up once it yields true.
+ * @return std::vector<int> An approximate closed tour, or an empty vector if stopped.
+ */
+std::vector<int> nearest_neighbor_tour(const std::vector<std::vector<float>>& graph, const std::function<bool()>& shouldStop = nullptr);
+/**
+ * @brief Runs a single 2-opt improvement pass over a closed tour.
+ * 
+ * The tour must start and end at the same vertex, as returned by the constructors above. Every improving
+ * segment reversal found is applied in place, so the tour stays valid even if the pass is interrupted.
+ * 
+ * @param graph The input graph represented as a 2D vector of floats.
+ * @param tour The closed tour to be improved in place.
+ * @param shouldStop Optional predicate polled between outer iterations; the pass returns early once it yields true.
+ * @return bool True if at least one improving move was applied.
  */
-std::vector<int> twice_around_the_tree(const std::vector<std::vector<float>>& graph);
\ No newline at end of file
+bool two_opt_pass(const std::vector<std::vector<float>>& graph, std::vector<int>& tour, const std::function<bool()>& shouldStop = nullptr);
\ No newline at end of file
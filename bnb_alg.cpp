@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <chrono>
+#include <functional>
 #include <queue>
 #include <limits>
 #include <iostream>
@@ -130,24 +131,20 @@ void printVector(std::vector<int> vec) {
   std::cout << std::endl;
 }
 
-std::vector<int> branchAndBound(std::vector<std::vector<float>> graph) {
+std::vector<int> branchAndBound(std::vector<std::vector<float>> graph, float upperBound,
+                                const std::function<bool()>& shouldStop,
+                                const std::function<void(const std::vector<int>&, float)>& onImprovement) {
   int n = graph.size();
   std::priority_queue<Node> queue;
-  std::vector<int> bestPath(n);
-  float bestCost = FLT_MAX;
+  std::vector<int> bestPath;
+  float bestCost = upperBound;
 
   Node root(1, 0, 0, {0});
   root.bound = calculateBound(graph, root, root);
   queue.push(root);
 
-  // Start the timer
-  auto startTime = std::chrono::steady_clock::now();
-
   while(!queue.empty()) {
-    // Check if the execution time exceeds 30 minutes
-    auto currentTime = std::chrono::steady_clock::now();
-    auto elapsedTime = std::chrono::duration_cast<std::chrono::minutes>(currentTime - startTime).count();
-    if (elapsedTime >= 30) {
+    if (shouldStop && shouldStop()) {
       return {};
     }
 
@@ -155,9 +152,13 @@ std::vector<int> branchAndBound(std::vector<std::vector<float>> graph) {
     queue.pop();
 
     if(node.level > n) {
-      if(bestCost > node.pathCost) {
+      // Require a real gain, so float rounding on an equal tour is not reported as an improvement
+      if(node.pathCost < bestCost - 1e-4f) {
         bestCost = node.pathCost; 
         bestPath = node.path;
+        if (onImprovement) {
+          onImprovement(bestPath, bestCost);
+        }
       }
     } else if(node.bound < bestCost) {
       if(node.level < n) {
@@ -183,4 +184,17 @@ std::vector<int> branchAndBound(std::vector<std::vector<float>> graph) {
   }
 
   return bestPath;
+}
+
+std::vector<int> branchAndBound(std::vector<std::vector<float>> graph) {
+  // Start the timer
+  auto startTime = std::chrono::steady_clock::now();
+
+  // Give up if the execution time exceeds 30 minutes
+  auto exceededTimeLimit = [&startTime]() {
+    auto currentTime = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::minutes>(currentTime - startTime).count() >= 30;
+  };
+
+  return branchAndBound(std::move(graph), FLT_MAX, exceededTimeLimit, nullptr);
 }
\ No newline at end of file
@@ -1,3 +1,28 @@
+#include <functional>
 #include <vector>
 
-std::vector<int> branchAndBound(std::vector<std::vector<float>> graph);
\ No newline at end of file
+/**
+ * @brief Solves the Traveling Salesman Problem (TSP) exactly using best-first branch and bound.
+ * 
+ * Gives up and returns an empty path if no optimal tour is proven within 30 minutes.
+ * 
+ * @param graph The input graph represented as a 2D vector of floats.
+ * @return std::vector<int> The optimal closed tour, or an empty vector on timeout.
+ */
+std::vector<int> branchAndBound(std::vector<std::vector<float>> graph);
+
+/**
+ * @brief Branch and bound with a caller-supplied incumbent cost and stop condition.
+ * 
+ * Only tours cheaper than upperBound by more than 1e-4 are accepted, which lets an already known heuristic tour prune
+ * the search from the start. Every accepted tour is reported through onImprovement as soon as it is found.
+ * 
+ * @param graph The input graph represented as a 2D vector of floats.
+ * @param upperBound Cost of the best tour known so far.
+ * @param shouldStop Predicate polled before each node expansion; the search is abandoned once it yields true.
+ * @param onImprovement Optional callback receiving each new best closed tour and its cost.
+ * @return std::vector<int> The optimal closed tour, or an empty vector if the search was stopped or nothing beat upperBound.
+ */
+std::vector<int> branchAndBound(std::vector<std::vector<float>> graph, float upperBound,
+                                const std::function<bool()>& shouldStop,
+                                const std::function<void(const std::vector<int>&, float)>& onImprovement);
\ No newline at end of file
@@ -0,0 +1,275 @@
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <thread>
+
+#include "approx_algs.hpp"
+#include "decomposition_alg.hpp"
+#include "tsp_utils.hpp"
+
+/**
+ * Recursively splits points at the median of the longest side of their bounding box until every region
+ * holds at most maxClusterSize points.
+ *
+ * @param points The coordinates of the cities.
+ * @param indices The indices of the points being partitioned, reordered in place.
+ * @param begin The first position of the current region in indices.
+ * @param end One past the last position of the current region in indices.
+ * @param maxClusterSize The maximum number of points in a region.
+ * @param clusters The output list of regions, each one a list of point indices.
+ */
+static void bisect_points(const std::vector<std::tuple<float, float>>& points, std::vector<int>& indices, size_t begin, size_t end,
+                          size_t maxClusterSize, std::vector<std::vector<int>>& clusters) {
+  if (end - begin <= maxClusterSize) {
+    clusters.emplace_back(indices.begin() + begin, indices.begin() + end);
+    return;
+  }
+
+  float minX = std::numeric_limits<float>::max(), maxX = std::numeric_limits<float>::lowest();
+  float minY = std::numeric_limits<float>::max(), maxY = std::numeric_limits<float>::lowest();
+  for (size_t i = begin; i < end; ++i) {
+    auto [x, y] = points[indices[i]];
+    minX = std::min(minX, x);
+    maxX = std::max(maxX, x);
+    minY = std::min(minY, y);
+    maxY = std::max(maxY, y);
+  }
+
+  bool splitOnX = maxX - minX >= maxY - minY;
+  size_t middle = begin + (end - begin) / 2;
+  std::nth_element(indices.begin() + begin, indices.begin() + middle, indices.begin() + end, [&](int a, int b) {
+    return splitOnX ? std::get<0>(points[a]) < std::get<0>(points[b]) : std::get<1>(points[a]) < std::get<1>(points[b]);
+  });
+
+  bisect_points(points, indices, begin, middle, maxClusterSize, clusters);
+  bisect_points(points, indices, middle, end, maxClusterSize, clusters);
+}
+
+/**
+ * Builds the closed tour visiting 0, 1, ..., n-1 in order.
+ *
+ * Used as a last resort when a constructor returns a tour that misses cities.
+ *
+ * @param n The number of vertices.
+ * @return std::vector<int> The identity closed tour.
+ */
+static std::vector<int> identity_tour(size_t n) {
+  std::vector<int> tour(n + 1);
+  for (size_t i = 0; i < n; ++i) {
+    tour[i] = i;
+  }
+  tour[n] = 0;
+  return tour;
+}
+
+/**
+ * Solves a single region with one of the constructors followed by 2-opt until no improving move is left.
+ *
+ * @param points The coordinates of all cities.
+ * @param cluster The indices of the cities in the region.
+ * @param useChristofides Whether to build the initial tour with Christofides instead of Twice Around the Tree.
+ * @return std::vector<int> A closed tour over the region, in global city indices.
+ */
+static std::vector<int> solve_cluster(const std::vector<std::tuple<float, float>>& points, const std::vector<int>& cluster, bool useChristofides) {
+  std::vector<std::tuple<float, float>> localPoints(cluster.size());
+  for (size_t i = 0; i < cluster.size(); ++i) {
+    localPoints[i] = points[cluster[i]];
+  }
+
+  std::vector<std::vector<float>> matrix(cluster.size(), std::vector<float>(cluster.size()));
+  fill_matrix_with_distances(matrix, localPoints);
+
+  std::vector<int> tour;
+  if (useChristofides && cluster.size() > 3) {
+    tour = christofides_tsp(matrix);
+  }
+  if (!is_valid_tour(tour, cluster.size())) {
+    tour = twice_around_the_tree(matrix);
+  }
+  if (!is_valid_tour(tour, cluster.size())) {
+    tour = identity_tour(cluster.size());
+  }
+  while (two_opt_pass(matrix, tour)) {}
+
+  for (int& vertex : tour) {
+    vertex = cluster[vertex];
+  }
+  return tour;
+}
+
+/**
+ * Runs 2-opt restricted to the positions [begin, end] of an open tour, until no improving move is left.
+ *
+ * Only segments inside the window are reversed, so the rest of the tour is untouched.
+ *
+ * @param points The coordinates of the cities.
+ * @param tour The open tour, where the last city connects back to the first one.
+ * @param begin The first position that may move, at least 1.
+ * @param end The last position that may move.
+ */
+static void two_opt_window(const std::vector<std::tuple<float, float>>& points, std::vector<int>& tour, size_t begin, size_t end) {
+  size_t n = tour.size();
+  auto distance = [&](size_t a, size_t b) { return (double)euclidean_distance(points[tour[a]], points[tour[b % n]]); };
+
+  bool improved = true;
+  while (improved) {
+    improved = false;
+    for (size_t i = begin; i < end; ++i) {
+      for (size_t j = i + 1; j <= end; ++j) {
+        double delta = distance(i - 1, j) + distance(i, j + 1) - distance(i - 1, i) - distance(j, j + 1);
+        if (delta < -1e-4) {
+          std::reverse(tour.begin() + i, tour.begin() + j + 1);
+          improved = true;
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Runs the decomposition on a set of pairwise distinct points.
+ *
+ * @param points The coordinates of the cities, without duplicates.
+ * @param options Region size, thread count and constructor selection.
+ * @return std::vector<int> An approximate closed tour.
+ */
+static std::vector<int> decompose_distinct_points(const std::vector<std::tuple<float, float>>& points, const DecompositionOptions& options) {
+  size_t n = points.size();
+
+  // Partition the points into regions
+  std::vector<int> indices(n);
+  for (size_t i = 0; i < n; ++i) {
+    indices[i] = i;
+  }
+  std::vector<std::vector<int>> clusters;
+  bisect_points(points, indices, 0, n, std::max(options.maxClusterSize, 1), clusters);
+  size_t k = clusters.size();
+
+  // Solve the regions on worker threads
+  std::vector<std::vector<int>> clusterTours(k);
+  std::atomic<size_t> nextCluster{0};
+  auto worker = [&]() {
+    for (size_t c = nextCluster++; c < k; c = nextCluster++) {
+      clusterTours[c] = solve_cluster(points, clusters[c], options.useChristofides);
+    }
+  };
+
+  size_t numThreads = options.numThreads > 0 ? options.numThreads : std::max(1u, std::thread::hardware_concurrency());
+  numThreads = std::min(numThreads, k);
+  std::vector<std::thread> workers;
+  for (size_t t = 1; t < numThreads; ++t) {
+    workers.emplace_back(worker);
+  }
+  worker();
+  for (std::thread& thread : workers) {
+    thread.join();
+  }
+
+  // Visit the regions in the order of a tour over their centroids
+  std::vector<std::tuple<float, float>> centroids(k);
+  for (size_t c = 0; c < k; ++c) {
+    float x = 0, y = 0;
+    for (int vertex : clusters[c]) {
+      x += std::get<0>(points[vertex]);
+      y += std::get<1>(points[vertex]);
+    }
+    centroids[c] = std::make_tuple(x / clusters[c].size(), y / clusters[c].size());
+  }
+  std::vector<std::vector<float>> centroidMatrix(k, std::vector<float>(k));
+  fill_matrix_with_distances(centroidMatrix, centroids);
+  std::vector<int> order = twice_around_the_tree(centroidMatrix);
+  if (!is_valid_tour(order, k)) {
+    // Regions sharing a centroid are zero apart, which the constructor treats as a missing edge
+    order = identity_tour(k);
+  }
+  while (two_opt_pass(centroidMatrix, order)) {}
+  order.pop_back();
+
+  // Stitch the region tours, cutting each one next to the end of the previous region
+  std::vector<int> tour;
+  std::vector<size_t> seams;
+  tour.reserve(n + 1);
+  for (size_t c = 0; c < k; ++c) {
+    const std::vector<int>& cycle = clusterTours[order[c]];
+    size_t m = cycle.size() - 1;
+
+    std::tuple<float, float> from = tour.empty() ? centroids[order[k - 1]] : points[tour.back()];
+    size_t entry = 0;
+    for (size_t i = 1; i < m; ++i) {
+      if (euclidean_distance(points[cycle[i]], from) < euclidean_distance(points[cycle[entry]], from)) {
+        entry = i;
+      }
+    }
+
+    // Walk the cycle in the direction whose last city is closer to the next region
+    std::tuple<float, float> to = c + 1 < k ? centroids[order[c + 1]] : points[tour.empty() ? cycle[entry] : tour.front()];
+    bool forward = euclidean_distance(points[cycle[(entry + m - 1) % m]], to) <= euclidean_distance(points[cycle[(entry + 1) % m]], to);
+
+    if (!tour.empty()) {
+      seams.push_back(tour.size());
+    }
+    for (size_t step = 0; step < m; ++step) {
+      tour.push_back(cycle[forward ? (entry + step) % m : (entry + m - step) % m]);
+    }
+  }
+
+  // Rotate the tour to start inside the first region, so that the closing seam can be smoothed too
+  size_t shift = clusters[order[0]].size() / 2;
+  std::rotate(tour.begin(), tour.begin() + shift, tour.end());
+  for (size_t& seam : seams) {
+    seam -= shift;
+  }
+  if (k > 1) {
+    seams.push_back(n - shift);
+  }
+
+  // Smooth the boundaries between regions
+  size_t window = std::max(options.boundaryWindow, 1);
+  for (size_t seam : seams) {
+    size_t begin = seam > window ? seam - window : 1;
+    size_t end = std::min(seam + window - 1, n - 1);
+    if (begin < end) {
+      two_opt_window(points, tour, begin, end);
+    }
+  }
+
+  tour.push_back(tour[0]);
+  return tour;
+}
+
+
+std::vector<int> decomposition_tsp(const std::vector<std::tuple<float, float>>& points, const DecompositionOptions& options) {
+  size_t n = points.size();
+  if (n == 0) {
+    return {};
+  }
+
+  // Collapse coincident points, since the constructors treat zero distances as missing edges
+  std::vector<int> sorted(n);
+  for (size_t i = 0; i < n; ++i) {
+    sorted[i] = i;
+  }
+  std::sort(sorted.begin(), sorted.end(), [&](int a, int b) { return points[a] < points[b]; });
+
+  std::vector<std::tuple<float, float>> distinctPoints;
+  std::vector<size_t> groupStart;
+  for (size_t i = 0; i < n; ++i) {
+    if (i == 0 || points[sorted[i]] != points[sorted[i - 1]]) {
+      distinctPoints.push_back(points[sorted[i]]);
+      groupStart.push_back(i);
+    }
+  }
+  groupStart.push_back(n);
+
+  std::vector<int> distinctTour = decompose_distinct_points(distinctPoints, options);
+
+  // Splice every coincident city back right after the first one of its group
+  std::vector<int> tour;
+  tour.reserve(n + 1);
+  for (size_t i = 0; i + 1 < distinctTour.size(); ++i) {
+    int group = distinctTour[i];
+    tour.insert(tour.end(), sorted.begin() + groupStart[group], sorted.begin() + groupStart[group + 1]);
+  }
+  tour.push_back(tour[0]);
+  return tour;
+}
\ No newline at end of file
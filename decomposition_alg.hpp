@@ -0,0 +1,29 @@
+#pragma once
+
+#include <tuple>
+#include <vector>
+
+/**
+ * @brief Tuning knobs for decomposition_tsp.
+ */
+struct DecompositionOptions {
+  int maxClusterSize = 500; // Regions are bisected until they hold at most this many cities
+  int numThreads = 0; // Worker threads solving regions, 0 uses every hardware thread
+  bool useChristofides = false; // Build region tours with Christofides instead of Twice Around the Tree
+  int boundaryWindow = 50; // Cities on each side of a seam considered when smoothing it
+};
+
+/**
+ * @brief Approximate the Traveling Salesman Problem (TSP) on large instances by spatial decomposition.
+ *
+ * The points are recursively bisected into regions, each region is solved independently on a worker thread
+ * with one of the constructors followed by 2-opt, and the region tours are stitched into a single tour in the
+ * order of a tour over the region centroids. A windowed 2-opt then smooths every seam. No full distance matrix
+ * is ever built, so memory grows linearly with the number of points. Coincident points are solved as a single
+ * city and visited consecutively.
+ *
+ * @param points The coordinates of the cities.
+ * @param options Region size, thread count and constructor selection.
+ * @return std::vector<int> An approximate closed tour, or an empty vector if there are no points.
+ */
+std::vector<int> decomposition_tsp(const std::vector<std::tuple<float, float>>& points, const DecompositionOptions& options = DecompositionOptions());
@@ -11,6 +11,8 @@
 #include "approx_algs.hpp"
 #include "tsp_utils.hpp"
 #include "bnb_alg.hpp"
+#include "decomposition_alg.hpp"
+#include "tsp_solver.hpp"
 
 /**
  * Reads a TSP file input and returns a vector of tuples representing the coordinates.
@@ -86,6 +88,22 @@ std::vector<int> read_tour_file(const std::string& filePath) {
   return tour;
 }
 
+/**
+ * Returns a printable name for a stage of the anytime solver.
+ *
+ * @param stage The solver stage.
+ * @return The name of the stage.
+ */
+std::string stage_name(SolverStage stage) {
+  switch (stage) {
+    case SolverStage::Initial: return "Initial";
+    case SolverStage::Construction: return "Construction";
+    case SolverStage::Improvement: return "Improvement";
+    case SolverStage::ExactSearch: return "Exact Search";
+  }
+  return "";
+}
+
 void print_minutes_and_second(long seconds) {
   seconds %= 3600;
   int minutes = seconds / 60;
@@ -101,6 +119,10 @@ void print_minutes_and_second(long seconds) {
  * and applies two different algorithms to approximate the Traveling Salesman Problem (TSP).
  * It then prints the paths and weights of the approximations, as well as the execution time.
  * 
+ * Passing --decompose after the dataset name runs only the decomposition algorithm instead, which never builds
+ * the distance matrix and is meant for the largest instances. Passing --solve followed by a number of
+ * milliseconds runs only the anytime TspSolver with that time budget, printing every improvement it finds.
+ * 
  * @return 0 indicating successful execution of the program.
  */
 int main(int argc, char** argv) {
@@ -117,10 +139,59 @@ int main(int argc, char** argv) {
   }
   std::vector<std::tuple<float, float>> points = read_tsp_file_input(FILE_PATH);
 
+  if (argc > 2 && std::string(argv[2]) == "--decompose") {
+    // Decomposition TSP
+    auto start_decomp = std::chrono::high_resolution_clock::now();
+    std::vector<int> walk_decomp = decomposition_tsp(points);
+
+    std::cout << "Decomposition TSP Algorithm: " << std::endl;
+    std::cout << "Weight: " << calculate_path_weight(points, walk_decomp) << std::endl;
+
+    auto stop_decomp = std::chrono::high_resolution_clock::now();
+    auto duration_decomp = std::chrono::duration_cast<std::chrono::seconds>(stop_decomp - start_decomp);
+    print_minutes_and_second(duration_decomp.count());
+
+    // Compare with optimal solution
+    std::vector<int> optimal_tour = read_tour_file(TOUR_FILE_PATH);
+    if(optimal_tour.size()) {
+      std::cout << "Given Optimal solution: " << std::endl;
+      std::cout << "Weight: " << calculate_path_weight(points, optimal_tour) << std::endl;
+    }
+
+    return 0;
+  }
+
   // Create a matrix
   std::vector<std::vector<float>> matrix(points.size(), std::vector<float>(points.size()));
   fill_matrix_with_distances(matrix, points);
 
+  if (argc > 3 && std::string(argv[2]) == "--solve") {
+    // Anytime TSP
+    SolverOptions options;
+    options.timeBudget = std::chrono::milliseconds(std::stol(argv[3]));
+    TspSolver solver(matrix, options);
+    solver.setImprovementCallback([](const std::vector<int>& tour, float weight, SolverStage stage) {
+      std::cout << stage_name(stage) << ": new best weight " << weight << std::endl;
+    });
+
+    auto start_solver = std::chrono::high_resolution_clock::now();
+    std::vector<int> walk_solver = solver.solve();
+
+    std::cout << "Anytime TSP Solver: " << std::endl;
+    std::cout << "Path: [";
+    for (const auto& vertex : walk_solver) {
+      std::cout << vertex << " ";
+    }
+    std::cout << "]" << std::endl;
+    std::cout << "Weight: " << calculate_path_weight(matrix, walk_solver) << std::endl;
+
+    auto stop_solver = std::chrono::high_resolution_clock::now();
+    auto duration_solver = std::chrono::duration_cast<std::chrono::seconds>(stop_solver - start_solver);
+    print_minutes_and_second(duration_solver.count());
+
+    return 0;
+  }
+
   // Twice Around the Tree TSP
   auto start_approx = std::chrono::high_resolution_clock::now();
   std::vector<int> walk_approx = twice_around_the_tree(matrix);
@@ -0,0 +1,110 @@
+#include "approx_algs.hpp"
+#include "bnb_alg.hpp"
+#include "tsp_solver.hpp"
+#include "tsp_utils.hpp"
+
+TspSolver::TspSolver(const std::vector<std::vector<float>>& graph, SolverOptions options)
+    : graph(graph), options(options) {}
+
+void TspSolver::setCancellationToken(const CancellationToken* token) {
+  this->token = token;
+}
+
+void TspSolver::setImprovementCallback(ImprovementCallback callback) {
+  this->callback = std::move(callback);
+}
+
+bool TspSolver::shouldStop() {
+  ++iterations;
+  if (token != nullptr && token->isCancelled()) {
+    return true;
+  }
+  if (options.iterationBudget > 0 && iterations > options.iterationBudget) {
+    return true;
+  }
+  return options.timeBudget.count() > 0 && std::chrono::steady_clock::now() >= deadline;
+}
+
+void TspSolver::offer(const std::vector<int>& tour, SolverStage stage) {
+  if (is_valid_tour(tour, graph.size())) {
+    offer(tour, calculate_path_weight(graph, tour), stage);
+  }
+}
+
+void TspSolver::offer(const std::vector<int>& tour, float weight, SolverStage stage) {
+  {
+    std::lock_guard<std::mutex> lock(bestMutex);
+    if (!best.empty() && weight >= bestCost) {
+      return;
+    }
+    best = tour;
+    bestCost = weight;
+  }
+  if (callback) {
+    callback(tour, weight, stage);
+  }
+}
+
+std::vector<int> TspSolver::solve() {
+  int n = graph.size();
+  deadline = std::chrono::steady_clock::now() + options.timeBudget;
+  iterations = 0;
+  {
+    std::lock_guard<std::mutex> lock(bestMutex);
+    best.clear();
+    bestCost = 0;
+  }
+  if (n == 0) {
+    return {};
+  }
+
+  // Start from the identity tour so that a valid answer exists before any stage runs
+  std::vector<int> identity(n + 1);
+  for (int i = 0; i < n; ++i) {
+    identity[i] = i;
+  }
+  identity[n] = 0;
+  offer(identity, SolverStage::Initial);
+
+  // Every tour on three or fewer cities has the same weight
+  if (n <= 3) {
+    return bestTour();
+  }
+
+  auto stop = [this]() { return shouldStop(); };
+
+  // Construction, cheapest first so that even a short budget ends with a real tour
+  offer(nearest_neighbor_tour(graph, stop), SolverStage::Construction);
+  offer(twice_around_the_tree(graph, stop), SolverStage::Construction);
+  if (options.useChristofides) {
+    offer(christofides_tsp(graph, stop), SolverStage::Construction);
+  }
+
+  // Improvement
+  if (options.useImprovement && !shouldStop()) {
+    std::vector<int> tour = bestTour();
+    while (two_opt_pass(graph, tour, stop)) {
+      offer(tour, SolverStage::Improvement);
+    }
+    // The last pass may have been interrupted after applying some moves
+    offer(tour, SolverStage::Improvement);
+  }
+
+  // Exact search, seeded with the best heuristic tour as the upper bound
+  if (n <= options.exactSearchMaxCities && !shouldStop()) {
+    branchAndBound(graph, bestWeight(), stop,
+                   [this](const std::vector<int>& tour, float weight) { offer(tour, weight, SolverStage::ExactSearch); });
+  }
+
+  return bestTour();
+}
+
+std::vector<int> TspSolver::bestTour() const {
+  std::lock_guard<std::mutex> lock(bestMutex);
+  return best;
+}
+
+float TspSolver::bestWeight() const {
+  std::lock_guard<std::mutex> lock(bestMutex);
+  return bestCost;
+}
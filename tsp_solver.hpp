@@ -0,0 +1,151 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+/**
+ * @class CancellationToken
+ * @brief A flag that lets another thread ask a running solver to stop.
+ *
+ * The solver only polls the token, so cancelling never interrupts a stage midway through an update:
+ * the best tour kept by the solver is always complete and valid.
+ */
+class CancellationToken {
+private:
+  std::atomic<bool> cancelled{false};
+
+public:
+  /**
+   * @brief Requests the solver to stop as soon as it next polls the token.
+   */
+  void cancel() {
+    cancelled.store(true);
+  }
+
+  /**
+   * @brief Checks if cancellation was requested.
+   *
+   * @return True if cancel() was called, false otherwise.
+   */
+  bool isCancelled() const {
+    return cancelled.load();
+  }
+};
+
+/**
+ * @brief The stages of the anytime pipeline, in the order they run.
+ */
+enum class SolverStage {
+  Initial,
+  Construction,
+  Improvement,
+  ExactSearch
+};
+
+/**
+ * @brief Budgets and stage selection for TspSolver.
+ *
+ * A zero budget means unlimited. An iteration is one step at which a stage polls the solver: a vertex added
+ * by a constructor, an outer loop of a 2-opt pass or a node expanded by branch and bound.
+ */
+struct SolverOptions {
+  std::chrono::milliseconds timeBudget{0};
+  long long iterationBudget = 0;
+  bool useChristofides = true;
+  bool useImprovement = true;
+  int exactSearchMaxCities = 10; // Branch and bound only runs on instances up to this size
+};
+
+/**
+ * @brief Callback receiving each new best closed tour, its weight and the stage that produced it.
+ */
+using ImprovementCallback = std::function<void(const std::vector<int>& tour, float weight, SolverStage stage)>;
+
+/**
+ * @class TspSolver
+ * @brief An embeddable anytime solver for the Traveling Salesman Problem (TSP).
+ *
+ * Runs construction (Nearest Neighbor, Twice Around the Tree and Christofides), 2-opt improvement and, for small instances,
+ * branch and bound as a pipeline. A valid best tour is available from the moment solve() starts, and every
+ * stage polls the time budget, the iteration budget and the cancellation token, so the solver returns
+ * with the best tour found so far once any of them runs out.
+ *
+ * Polls are O(n) work apart, except for single O(n^2) memory operations in the MST-based constructors:
+ * allocating the n x n tree and growing Prim's heap. A stop can lag by one of these, which is a few hundred
+ * milliseconds at n = 5000 in an unoptimized build.
+ *
+ * The graph is held by reference and must outlive the solver. bestTour() and bestWeight() may be called
+ * from other threads while solve() is running.
+ */
+class TspSolver {
+private:
+  const std::vector<std::vector<float>>& graph;
+  SolverOptions options;
+  const CancellationToken* token = nullptr;
+  ImprovementCallback callback;
+
+  std::chrono::steady_clock::time_point deadline;
+  long long iterations = 0;
+
+  mutable std::mutex bestMutex;
+  std::vector<int> best;
+  float bestCost = 0;
+
+  bool shouldStop();
+  void offer(const std::vector<int>& tour, SolverStage stage);
+  void offer(const std::vector<int>& tour, float weight, SolverStage stage);
+
+public:
+  /**
+   * @brief Creates a solver for the given graph.
+   *
+   * @param graph The input graph represented as a symmetric 2D vector of floats.
+   * @param options Budgets and stage selection.
+   */
+  TspSolver(const std::vector<std::vector<float>>& graph, SolverOptions options = SolverOptions());
+
+  /**
+   * @brief Deleted, since the solver keeps a reference to the graph and a temporary would dangle.
+   */
+  TspSolver(std::vector<std::vector<float>>&& graph, SolverOptions options = SolverOptions()) = delete;
+
+  /**
+   * @brief Sets the token polled by every stage; pass nullptr to detach it.
+   *
+   * @param token The cancellation token, which must outlive solve().
+   */
+  void setCancellationToken(const CancellationToken* token);
+
+  /**
+   * @brief Sets the callback invoked every time the best tour improves.
+   *
+   * The callback runs on the thread calling solve().
+   *
+   * @param callback The improvement callback.
+   */
+  void setImprovementCallback(ImprovementCallback callback);
+
+  /**
+   * @brief Runs the pipeline until it finishes, a budget runs out or the token is cancelled.
+   *
+   * @return std::vector<int> The best closed tour found, or an empty vector for an empty graph.
+   */
+  std::vector<int> solve();
+
+  /**
+   * @brief Returns a copy of the best closed tour found so far.
+   *
+   * @return std::vector<int> The best tour.
+   */
+  std::vector<int> bestTour() const;
+
+  /**
+   * @brief Returns the weight of the best tour found so far.
+   *
+   * @return float The best tour weight.
+   */
+  float bestWeight() const;
+};
@@ -22,4 +22,27 @@ float calculate_path_weight(const std::vector<std::vector<float>>& graph, const
     totalWeight += graph[path[i]][path[i + 1]];
   }
   return totalWeight;
+}
+
+float calculate_path_weight(const std::vector<std::tuple<float, float>>& points, const std::vector<int>& path) {
+  float totalWeight = 0.0;
+  for (size_t i = 0; i + 1 < path.size(); ++i) {
+    totalWeight += euclidean_distance(points[path[i]], points[path[i + 1]]);
+  }
+  return totalWeight;
+}
+
+bool is_valid_tour(const std::vector<int>& tour, std::size_t n) {
+  if (tour.size() != n + 1 || tour.front() != tour.back()) {
+    return false;
+  }
+
+  std::vector<bool> visited(n, false);
+  for (std::size_t i = 0; i < n; ++i) {
+    if (tour[i] < 0 || static_cast<std::size_t>(tour[i]) >= n || visited[tour[i]]) {
+      return false;
+    }
+    visited[tour[i]] = true;
+  }
+  return true;
 }
\ No newline at end of file
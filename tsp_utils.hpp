@@ -1,3 +1,6 @@
+#pragma once
+
+#include <cstddef>
 #include <vector>
 #include <tuple>
 
@@ -28,4 +31,24 @@ void fill_matrix_with_distances(std::vector<std::vector<float>>& matrix, const s
  * @param path The path represented as a vector of node indices.
  * @return The total weight of the path.
  */
-float calculate_path_weight(const std::vector<std::vector<float>>& graph, const std::vector<int>& path);
\ No newline at end of file
+float calculate_path_weight(const std::vector<std::vector<float>>& graph, const std::vector<int>& path);
+
+/**
+ * Calculates the total weight of a given path directly from the point coordinates.
+ * 
+ * Useful on instances too large for a full distance matrix.
+ * 
+ * @param points The vector of points.
+ * @param path The path represented as a vector of node indices.
+ * @return The total weight of the path.
+ */
+float calculate_path_weight(const std::vector<std::tuple<float, float>>& points, const std::vector<int>& path);
+
+/**
+ * Checks if a path is a closed tour visiting every vertex exactly once.
+ * 
+ * @param tour The path represented as a vector of node indices.
+ * @param n The number of vertices in the graph.
+ * @return True if the tour is valid, false otherwise.
+ */
+bool is_valid_tour(const std::vector<int>& tour, std::size_t n);
\ No newline at end of file